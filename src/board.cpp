@@ -1,5 +1,6 @@
 
 #include <optional>
+#include <stdexcept>
 #include <unistd.h>
 #include <chrono>
 
@@ -15,7 +16,7 @@
  *
  *  Initializes a Board object with a table of size n x m.
  */
-Board::Board(std::size_t n, std::size_t m) : table(n, m) {}
+Board::Board(std::size_t n, std::size_t m) : table(n, m), hinted(false) {}
 
 /*
  *  launch_tasks()
@@ -36,6 +37,8 @@ Board::Board(std::size_t n, std::size_t m) : table(n, m) {}
  *  `rgol::solve_min_alive` function to find a solution with the
  *  fewest live cells.
  *
+ *  @support: The t0 support mask forwarded to both tasks.
+ *
  *  @wait_time: The total time in milliseconds to spend waiting for
  *  both tasks to complete. The function ensures that the tasks
  *  collectively do not exceed this time limit.
@@ -48,7 +51,7 @@ Board::Board(std::size_t n, std::size_t m) : table(n, m) {}
  *      - The second indicates whether the "minimum
  *      alive" task completed successfully.
  */
-std::pair<bool, bool> Board::launch_tasks(Board& any, Board& min, unsigned wait_time) const {
+std::pair<bool, bool> Board::launch_tasks(Board& any, Board& min, const Matrix<int>& support, unsigned wait_time) const {
 
     std::pair<bool, bool> ret(false, false);
 
@@ -57,8 +60,10 @@ std::pair<bool, bool> Board::launch_tasks(Board& any, Board& min, unsigned wait_
             return rgol::solve_iter(
                 table,
                 any.table,
+                support,
                 wait_time - 200,
                 std::thread::hardware_concurrency() - 1,
+                hinted,
                 ret.first
             );
         }
@@ -69,6 +74,7 @@ std::pair<bool, bool> Board::launch_tasks(Board& any, Board& min, unsigned wait_
             return rgol::solve(
                 table,
                 min.table,
+                support,
                 wait_time
             );
         }
@@ -126,19 +132,114 @@ std::pair<bool, bool> Board::launch_tasks(Board& any, Board& min, unsigned wait_
  */
 std::optional<Board> Board::previous_state(unsigned wait_time) const {
 
-    std::size_t n;
-    std::size_t m;
+    std::pair<bool, bool> status;
+
+    return previous_state(wait_time, status);
+}
+
+/*
+ *  previous_state()
+ *
+ *  Same as `previous_state(wait_time)`, additionally reporting how
+ *  the two solve tasks ended.
+ *
+ *  @wait_time: Timeout in seconds.
+ *
+ *  @status: Receives the result of `launch_tasks()`, as described
+ *  for `previous_state(support, wait_time, status)`.
+ *
+ *  return:
+ *    - `std::optional<Board>`: see `previous_state(wait_time)`.
+ */
+std::optional<Board> Board::previous_state(unsigned wait_time, std::pair<bool, bool>& status) const {
+
+    Board support(table.n(), table.m());
+
+    /* Without a mask every cell may be alive at t0 */
+    support.table = Matrix<int>(table.n(), table.m(), 1);
+
+    return previous_state(support, wait_time, status);
+}
+
+/*
+ *  previous_state()
+ *
+ *  This function computes the previous state of the current board in
+ *  Conway's Game of Life, restricting predecessor activity to the
+ *  given support mask.
+ *
+ *  @support: A Board of the same dimensions whose non-zero cells mark
+ *  where t0 cells may be alive. Every other cell is fixed dead and
+ *  is left out of the search.
+ *
+ *  @wait_time: Timeout in seconds.
+ *
+ *  return:
+ *    - `std::optional<Board>`:
+ *        - If a valid previous state is found, the function returns a
+ *        `Board` object representing this state.
+ *
+ *        - If no valid previous state exists (unsatisfiable
+ *        constraints), the function returns `std::nullopt` to
+ *        indicate failure.
+ *
+ *  throws:
+ *    - std::invalid_argument if the dimensions of `support` do not
+ *      match the dimensions of the board.
+ */
+std::optional<Board> Board::previous_state(const Board& support, unsigned wait_time) const {
 
     std::pair<bool, bool> status;
 
+    return previous_state(support, wait_time, status);
+}
+
+/*
+ *  previous_state()
+ *
+ *  Same as `previous_state(support, wait_time)`, additionally
+ *  reporting how the two solve tasks ended.
+ *
+ *  @support: A Board of the same dimensions whose non-zero cells mark
+ *  where t0 cells may be alive. Every other cell is fixed dead and
+ *  is left out of the search.
+ *
+ *  @wait_time: Timeout in seconds.
+ *
+ *  @status: Receives the result of `launch_tasks()`:
+ *    - The first `bool` is `true` if a predecessor was found. It is
+ *    `false` both for unsatisfiable boards and when no model was
+ *    found within `wait_time`.
+ *
+ *    - The second `bool` is `true` if the "minimum alive" task
+ *    finished in time, i.e. the returned state has the fewest
+ *    alive cells.
+ *
+ *  return:
+ *    - `std::optional<Board>`: see `previous_state(support,
+ *    wait_time)`.
+ *
+ *  throws:
+ *    - std::invalid_argument if the dimensions of `support` do not
+ *      match the dimensions of the board.
+ */
+std::optional<Board> Board::previous_state(const Board& support, unsigned wait_time, std::pair<bool, bool>& status) const {
+
+    std::size_t n;
+    std::size_t m;
+
     n = table.n();
     m = table.m();
 
+    if(support.table.n() != n || support.table.m() != m) {
+        throw std::invalid_argument("Support mask dimensions do not match the board.");
+    }
+
     Board unsat(n, m);
     Board any(n, m);
     Board min(n, m);
 
-    status = launch_tasks(any, min, 1000 * wait_time);
+    status = launch_tasks(any, min, support.table, 1000 * wait_time);
     if(!status.first) {
         return unsat;
     } else {
@@ -150,6 +251,40 @@ std::optional<Board> Board::previous_state(unsigned wait_time) const {
     return any;
 }
 
+/*
+ *  set_phase_hints()
+ *
+ *  Enables or disables phase hints for the "any solution" task of
+ *  `previous_state()`. When enabled, each solver check is first
+ *  tried assuming the t0 cells that local t1 window statistics
+ *  predict with confidence. This speeds up some boards and slows
+ *  down others, so it is off by default.
+ *
+ *  @enable: `true` to use phase hints, `false` otherwise.
+ */
+void Board::set_phase_hints(bool enable) {
+    hinted = enable;
+}
+
+/*
+ *  evolve()
+ *
+ *  Evolves the board forward in place, stopping early once a
+ *  generation repeats an earlier one (up to translation), which
+ *  is how still lifes, oscillators and spaceships are recognised
+ *  well before the generation cap.
+ *
+ *  @generations: The maximum number of generations to compute.
+ *
+ *  return:
+ *    - A `life::History` with the number of generations computed
+ *    and, if a repeat was found, the transient length, period and
+ *    displacement per period.
+ */
+life::History Board::evolve(std::size_t generations) {
+    return life::evolve(table, generations);
+}
+
 /*
  *  operator>>()
  *
@@ -6,6 +6,7 @@
 #include <z3++.h>
 
 #include "matrix.hpp"
+#include "life.hpp"
 
 class Board {
 
@@ -40,6 +41,111 @@ class Board {
      */
     std::optional<Board> previous_state(unsigned wait_time = 290) const;
 
+    /*
+     *  previous_state()
+     *
+     *  Same as `previous_state(wait_time)`, additionally reporting how
+     *  the two solve tasks ended.
+     *
+     *  @wait_time: Timeout in seconds.
+     *
+     *  @status: Receives the result of `launch_tasks()`, as described
+     *  for `previous_state(support, wait_time, status)`.
+     *
+     *  return:
+     *    - `std::optional<Board>`: see `previous_state(wait_time)`.
+     */
+    std::optional<Board> previous_state(unsigned wait_time, std::pair<bool, bool>& status) const;
+
+    /*
+     *  previous_state()
+     *
+     *  This function computes the previous state of the current board in
+     *  Conway's Game of Life, restricting predecessor activity to the
+     *  given support mask.
+     *
+     *  @support: A Board of the same dimensions whose non-zero cells mark
+     *  where t0 cells may be alive. Every other cell is fixed dead and
+     *  is left out of the search.
+     *
+     *  @wait_time: Timeout in seconds.
+     *
+     *  return:
+     *    - `std::optional<Board>`:
+     *        - If a valid previous state is found, the function returns a
+     *        `Board` object representing this state.
+     *
+     *        - If no valid previous state exists (unsatisfiable
+     *        constraints), the function returns `std::nullopt` to
+     *        indicate failure.
+     *
+     *  throws:
+     *    - std::invalid_argument if the dimensions of `support` do not
+     *      match the dimensions of the board.
+     */
+    std::optional<Board> previous_state(const Board& support, unsigned wait_time = 290) const;
+
+    /*
+     *  previous_state()
+     *
+     *  Same as `previous_state(support, wait_time)`, additionally
+     *  reporting how the two solve tasks ended.
+     *
+     *  @support: A Board of the same dimensions whose non-zero cells mark
+     *  where t0 cells may be alive. Every other cell is fixed dead and
+     *  is left out of the search.
+     *
+     *  @wait_time: Timeout in seconds.
+     *
+     *  @status: Receives the result of `launch_tasks()`:
+     *    - The first `bool` is `true` if a predecessor was found. It is
+     *    `false` both for unsatisfiable boards and when no model was
+     *    found within `wait_time`.
+     *
+     *    - The second `bool` is `true` if the "minimum alive" task
+     *    finished in time, i.e. the returned state has the fewest
+     *    alive cells.
+     *
+     *  return:
+     *    - `std::optional<Board>`: see `previous_state(support,
+     *    wait_time)`.
+     *
+     *  throws:
+     *    - std::invalid_argument if the dimensions of `support` do not
+     *      match the dimensions of the board.
+     */
+    std::optional<Board> previous_state(const Board& support, unsigned wait_time, std::pair<bool, bool>& status) const;
+
+    /*
+     *  set_phase_hints()
+     *
+     *  Enables or disables phase hints for the "any solution" task of
+     *  `previous_state()`. When enabled, each solver check is first
+     *  tried assuming the t0 cells that local t1 window statistics
+     *  predict with confidence. This speeds up some boards and slows
+     *  down others, so it is off by default.
+     *
+     *  @enable: `true` to use phase hints, `false` otherwise.
+     */
+    void set_phase_hints(bool enable);
+
+    /*
+     *  evolve()
+     *
+     *  Evolves the board forward in place, stopping early once a
+     *  generation repeats an earlier one (up to translation), which
+     *  is how still lifes, oscillators and spaceships are recognised
+     *  well before the generation cap.
+     *
+     *  @generations: The maximum number of generations to compute.
+     *
+     *  return:
+     *    - A `life::History` with the number of generations computed
+     *    and, if a repeat was found, the transient length, period and
+     *    displacement per period.
+     */
+    life::History evolve(std::size_t generations);
+
     /*
      *  operator>>()
      *
@@ -106,6 +212,8 @@ class Board {
      *  `rgol::solve_min_alive` function to find a solution with the
      *  fewest live cells.
      *
+     *  @support: The t0 support mask forwarded to both tasks.
+     *
      *  @wait_time: The total time in milliseconds to spend waiting for
      *  both tasks to complete. The function ensures that the tasks
      *  collectively do not exceed this time limit.
@@ -118,11 +226,12 @@ class Board {
      *      - The second `bool` (`m`) indicates whether the "minimum
      *      alive" task completed successfully.
      */
-    std::pair<bool, bool> launch_tasks(Board& any, Board& min, unsigned wait_time) const;
+    std::pair<bool, bool> launch_tasks(Board& any, Board& min, const Matrix<int>& support, unsigned wait_time) const;
 
     private:
 
     Matrix<int> table;
+    bool hinted;
 };
 
 #endif  /* BOARD_HPP */
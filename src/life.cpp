@@ -0,0 +1,210 @@
+
+#include <algorithm>
+#include <cstdint>
+#include <vector>
+#include <utility>
+
+#include "life.hpp"
+
+namespace life {
+
+    namespace {
+
+        /*
+         *  Snapshot
+         *
+         *  A generation cropped to the bounding box of its live cells,
+         *  together with its hash, when it was seen and where the box
+         *  was anchored. The empty board has a 0 x 0 box at (0, 0).
+         */
+        struct Snapshot {
+            std::uint64_t hash = 0;
+            std::size_t gen = 0;
+            std::size_t top = 0;
+            std::size_t left = 0;
+            std::size_t rows = 0;
+            std::size_t cols = 0;
+            std::vector<unsigned char> cells;
+        };
+
+        /*
+         *  snapshot()
+         *
+         *  Crops a board to the bounding box of its live cells and
+         *  hashes the result, so that two generations that only differ
+         *  by a translation get the same hash and cropped pattern.
+         *
+         *  @board: The board to crop.
+         *
+         *  @gen: The generation number of `board`.
+         *
+         *  @snap: Receives the cropped pattern. Its buffer is reused.
+         */
+        static void snapshot(const Matrix<int>& board, std::size_t gen, Snapshot& snap) {
+
+            std::size_t i;
+            std::size_t j;
+            std::size_t n;
+            std::size_t m;
+            std::size_t bottom;
+            std::size_t right;
+
+            constexpr std::uint64_t basis = 0xcbf29ce484222325ULL;
+            constexpr std::uint64_t prime = 0x100000001b3ULL;
+
+            n = board.n();
+            m = board.m();
+
+            snap.gen  = gen;
+            snap.top  = n;
+            snap.left = m;
+            bottom    = 0;
+            right     = 0;
+            for(i = 0; i < n; i++) {
+                for(j = 0; j < m; j++) {
+                    if(board(i, j)) {
+                        snap.top  = std::min(snap.top, i);
+                        snap.left = std::min(snap.left, j);
+                        bottom    = std::max(bottom, i);
+                        right     = std::max(right, j);
+                    }
+                }
+            }
+
+            snap.cells.clear();
+            snap.hash = basis;
+            if(snap.top == n) {
+                snap.top  = 0;
+                snap.left = 0;
+                snap.rows = 0;
+                snap.cols = 0;
+                return;
+            }
+
+            snap.rows = bottom - snap.top + 1;
+            snap.cols = right - snap.left + 1;
+            snap.hash = (snap.hash ^ snap.rows) * prime;
+            snap.hash = (snap.hash ^ snap.cols) * prime;
+            for(i = snap.top; i <= bottom; i++) {
+                for(j = snap.left; j <= right; j++) {
+                    snap.cells.push_back(board(i, j) ? 1 : 0);
+                    snap.hash = (snap.hash ^ snap.cells.back()) * prime;
+                }
+            }
+        }
+
+        /*
+         *  same_pattern()
+         *
+         *  @a: A cropped generation.
+         *  @b: Another cropped generation.
+         *
+         *  return:
+         *    - `true` if both hold the same pattern, regardless of where
+         *    it was anchored on the board.
+         */
+        static bool same_pattern(const Snapshot& a, const Snapshot& b) {
+            return a.hash == b.hash && a.rows == b.rows && a.cols == b.cols && a.cells == b.cells;
+        }
+    }
+
+    /*
+     *  step()
+     *
+     *  Computes the next generation of a Game of Life board. Cells
+     *  outside of the board are treated as permanently dead, the same
+     *  boundary the reverse solvers encode.
+     *
+     *  @t0: The current generation. Each cell is either `1` (alive) or
+     *  `0` (dead).
+     *
+     *  @t1: Receives the next generation. Must have the same
+     *  dimensions as `t0`.
+     */
+    void step(const Matrix<int>& t0, Matrix<int>& t1) {
+
+        std::size_t i;
+        std::size_t j;
+        std::size_t x;
+        std::size_t y;
+        std::size_t n;
+        std::size_t m;
+        unsigned neigh;
+
+        n = t0.n();
+        m = t0.m();
+        for(i = 0; i < n; i++) {
+            for(j = 0; j < m; j++) {
+                neigh = 0;
+                for(x = (i ? i - 1 : 0); x <= i + 1 && x < n; x++) {
+                    for(y = (j ? j - 1 : 0); y <= j + 1 && y < m; y++) {
+                        if((x != i || y != j) && t0(x, y)) {
+                            neigh++;
+                        }
+                    }
+                }
+
+                t1(i, j) = (neigh == 3 || (t0(i, j) && neigh == 2)) ? 1 : 0;
+            }
+        }
+    }
+
+    /*
+     *  evolve()
+     *
+     *  Evolves a board forward in place for at most `generations`
+     *  steps, stopping as soon as a generation repeats an earlier one.
+     *  Every generation is cropped to the bounding box of its live
+     *  cells, hashed and kept in a ring of the last `max_period`
+     *  generations; a hash hit is confirmed by comparing the cropped
+     *  patterns. Translated repeats (spaceships) are thus caught as
+     *  well as still lifes and oscillators.
+     *
+     *  @board: The board to evolve. On return it holds the last
+     *  generation computed.
+     *
+     *  @generations: The maximum number of generations to compute.
+     *
+     *  return:
+     *    - A `History` describing how far the run got and, if a repeat
+     *    was found, the transient length, period and displacement.
+     */
+    History evolve(Matrix<int>& board, std::size_t generations) {
+
+        std::size_t k;
+        std::size_t filled;
+
+        History hist;
+        Snapshot cur;
+        Matrix<int> next(board.n(), board.m());
+        std::vector<Snapshot> ring(max_period);
+
+        snapshot(board, 0, ring[0]);
+        filled = 1;
+
+        while(hist.generations < generations) {
+            step(board, next);
+            std::swap(board, next);
+            hist.generations++;
+
+            snapshot(board, hist.generations, cur);
+            for(k = 0; k < filled; k++) {
+                const Snapshot& seen = ring[k];
+                if(same_pattern(cur, seen)) {
+                    hist.cycle     = true;
+                    hist.transient = seen.gen;
+                    hist.period    = cur.gen - seen.gen;
+                    hist.dy        = (long)cur.top  - (long)seen.top;
+                    hist.dx        = (long)cur.left - (long)seen.left;
+                    return hist;
+                }
+            }
+
+            /* Overwrite the oldest generation, reusing its buffer */
+            std::swap(ring[hist.generations % max_period], cur);
+            filled = std::min(filled + 1, max_period);
+        }
+
+        return hist;
+    }
+}
@@ -0,0 +1,85 @@
+#ifndef LIFE_HPP
+#define LIFE_HPP
+
+#include <cstddef>
+
+#include "matrix.hpp"
+
+namespace life {
+
+    /*
+     *  Number of most recent generations kept by `evolve()`. Cycles
+     *  with a longer period are not detected.
+     */
+    constexpr std::size_t max_period = 256;
+
+    /*
+     *  History
+     *
+     *  Outcome of a forward evolution run.
+     *
+     *  @generations: The number of generations actually computed.
+     *
+     *  @cycle: `true` if a repeat of an earlier generation (possibly
+     *  translated) was seen before the generation cap was reached.
+     *
+     *  @transient: The generation at which the repeating pattern first
+     *  appeared. Only meaningful if `cycle` is set.
+     *
+     *  @period: The distance in generations between two repeats: `1`
+     *  for still lifes (and the empty board), `> 1` for oscillators and
+     *  spaceships. Only meaningful if `cycle` is set.
+     *
+     *  @dy: Row displacement of the pattern over one period. Non-zero
+     *  `dy` or `dx` means the pattern is a spaceship.
+     *
+     *  @dx: Column displacement of the pattern over one period.
+     */
+    struct History {
+        std::size_t generations = 0;
+        bool cycle = false;
+        std::size_t transient = 0;
+        std::size_t period = 0;
+        long dy = 0;
+        long dx = 0;
+    };
+
+    /*
+     *  step()
+     *
+     *  Computes the next generation of a Game of Life board. Cells
+     *  outside of the board are treated as permanently dead, the same
+     *  boundary the reverse solvers encode.
+     *
+     *  @t0: The current generation. Each cell is either `1` (alive) or
+     *  `0` (dead).
+     *
+     *  @t1: Receives the next generation. Must have the same
+     *  dimensions as `t0`.
+     */
+    extern void step(const Matrix<int>& t0, Matrix<int>& t1);
+
+    /*
+     *  evolve()
+     *
+     *  Evolves a board forward in place for at most `generations`
+     *  steps, stopping as soon as a generation repeats an earlier one.
+     *  Every generation is cropped to the bounding box of its live
+     *  cells, hashed and kept in a ring of the last `max_period`
+     *  generations; a hash hit is confirmed by comparing the cropped
+     *  patterns. Translated repeats (spaceships) are thus caught as
+     *  well as still lifes and oscillators.
+     *
+     *  @board: The board to evolve. On return it holds the last
+     *  generation computed.
+     *
+     *  @generations: The maximum number of generations to compute.
+     *
+     *  return:
+     *    - A `History` describing how far the run got and, if a repeat
+     *    was found, the transient length, period and displacement.
+     */
+    extern History evolve(Matrix<int>& board, std::size_t generations);
+};
+
+#endif  /* LIFE_HPP */
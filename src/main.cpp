@@ -1,17 +1,46 @@
 
+#include <unistd.h>
+
 #include "board.hpp"
 
-int main() {
+int main(int argc, char* argv[]) {
+
+    int c;
+    bool hinted;
 
     std::size_t n;
     std::size_t m;
 
+    /* -p: seed the solver with phase hints from t1 window statistics */
+    hinted = false;
+    while((c = getopt(argc, argv, "p")) != -1) {
+        if(c != 'p') {
+            std::cerr << "usage: " << argv[0] << " [-p] < board" << std::endl;
+            return 1;
+        }
+        hinted = true;
+    }
+
     std::cin >> n >> m;
 
     Board board(n, m);
+    board.set_phase_hints(hinted);
 
     std::cin >> board;
-    std::cout << board.previous_state() << std::endl;
+
+    /* An optional second n x m block restricts where t0 may be alive */
+    if(!(std::cin >> std::ws).eof()) {
+        Board support(n, m);
+
+        if(!(std::cin >> support)) {
+            std::cerr << "Cannot read support mask." << std::endl;
+            return 1;
+        }
+
+        std::cout << board.previous_state(support) << std::endl;
+    } else {
+        std::cout << board.previous_state() << std::endl;
+    }
 
     return 0;
 }
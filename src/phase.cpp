@@ -0,0 +1,151 @@
+
+#include <cstdint>
+
+#include "phase.hpp"
+
+namespace phase {
+
+    namespace {
+
+        /*
+         *  P(center t0 cell alive | 3x3 t1 window), indexed by the t1
+         *  window read row-major with the top-left cell as bit 0.
+         *
+         *  Obtained by enumerating every 5x5 t0 patch, stepping its
+         *  inner 3x3 forward and weighting each patch with an
+         *  independent per-cell density of 0.25. The sparse prior
+         *  matches what the solvers look for: predecessors with few
+         *  alive cells.
+         */
+        constexpr double window_stats[512] = {
+            0.0582, 0.1235, 0.1345, 0.1611, 0.1235, 0.2207, 0.1611, 0.2058,
+            0.1345, 0.1611, 0.2216, 0.1551, 0.2710, 0.2748, 0.2580, 0.2072,
+            0.2084, 0.3113, 0.2859, 0.3140, 0.3113, 0.3683, 0.3140, 0.3374,
+            0.2859, 0.3140, 0.3520, 0.2894, 0.4728, 0.4808, 0.3923, 0.3643,
+            0.1345, 0.2710, 0.2216, 0.2580, 0.1611, 0.2748, 0.1551, 0.2072,
+            0.1933, 0.2548, 0.2824, 0.1734, 0.2548, 0.2814, 0.1734, 0.1189,
+            0.2859, 0.4728, 0.3520, 0.3923, 0.3140, 0.4808, 0.2894, 0.3643,
+            0.4560, 0.5241, 0.4946, 0.4416, 0.5241, 0.6353, 0.4416, 0.4367,
+            0.1235, 0.2207, 0.2710, 0.2748, 0.2568, 0.3594, 0.3204, 0.3405,
+            0.1611, 0.2058, 0.2580, 0.2072, 0.3204, 0.3405, 0.3315, 0.3006,
+            0.3113, 0.3683, 0.4728, 0.4808, 0.5440, 0.5790, 0.5403, 0.5511,
+            0.3140, 0.3374, 0.3923, 0.3643, 0.5403, 0.5511, 0.4346, 0.4525,
+            0.2710, 0.4062, 0.3860, 0.3255, 0.3204, 0.4282, 0.2843, 0.2926,
+            0.2548, 0.3662, 0.2866, 0.2604, 0.3333, 0.4047, 0.2154, 0.2136,
+            0.4728, 0.5976, 0.6608, 0.6558, 0.5403, 0.6569, 0.6111, 0.6395,
+            0.5241, 0.6517, 0.6036, 0.5870, 0.5706, 0.6990, 0.5548, 0.5659,
+            0.1345, 0.2710, 0.1933, 0.2548, 0.2710, 0.4062, 0.2548, 0.3662,
+            0.2216, 0.2580, 0.2824, 0.1734, 0.3860, 0.3255, 0.2866, 0.2604,
+            0.2859, 0.4728, 0.4560, 0.5241, 0.4728, 0.5976, 0.5241, 0.6517,
+            0.3520, 0.3923, 0.4946, 0.4416, 0.6608, 0.6558, 0.6036, 0.5870,
+            0.2216, 0.3860, 0.2824, 0.2866, 0.2580, 0.3255, 0.1734, 0.2604,
+            0.2824, 0.2866, 0.1494, 0.1095, 0.2866, 0.2622, 0.1095, 0.0974,
+            0.3520, 0.6608, 0.4946, 0.6036, 0.3923, 0.6558, 0.4416, 0.5870,
+            0.4946, 0.6036, 0.5968, 0.5954, 0.6036, 0.7153, 0.5954, 0.6085,
+            0.1611, 0.2748, 0.2548, 0.2814, 0.3204, 0.4282, 0.3333, 0.4047,
+            0.1551, 0.2072, 0.1734, 0.1189, 0.2843, 0.2926, 0.2154, 0.2136,
+            0.3140, 0.4808, 0.5241, 0.6353, 0.5403, 0.6569, 0.5706, 0.6990,
+            0.2894, 0.3643, 0.4416, 0.4367, 0.6111, 0.6395, 0.5548, 0.5659,
+            0.2580, 0.3255, 0.2866, 0.2622, 0.3315, 0.3879, 0.2154, 0.2615,
+            0.1734, 0.2604, 0.1095, 0.0974, 0.2154, 0.2615, 0.0730, 0.0932,
+            0.3923, 0.6558, 0.6036, 0.7153, 0.4346, 0.6666, 0.5548, 0.7215,
+            0.4416, 0.5870, 0.5954, 0.6085, 0.5548, 0.7215, 0.6225, 0.6305,
+            0.1235, 0.2568, 0.2710, 0.3204, 0.2207, 0.3594, 0.2748, 0.3405,
+            0.2710, 0.3204, 0.3860, 0.2843, 0.4062, 0.4282, 0.3255, 0.2926,
+            0.3113, 0.5440, 0.4728, 0.5403, 0.3683, 0.5790, 0.4808, 0.5511,
+            0.4728, 0.5403, 0.6608, 0.6111, 0.5976, 0.6569, 0.6558, 0.6395,
+            0.1611, 0.3204, 0.2580, 0.3315, 0.2058, 0.3405, 0.2072, 0.3006,
+            0.2548, 0.3333, 0.2866, 0.2154, 0.3662, 0.4047, 0.2604, 0.2136,
+            0.3140, 0.5403, 0.3923, 0.4346, 0.3374, 0.5511, 0.3643, 0.4525,
+            0.5241, 0.5706, 0.6036, 0.5548, 0.6517, 0.6990, 0.5870, 0.5659,
+            0.2207, 0.3594, 0.4062, 0.4282, 0.3594, 0.4774, 0.4282, 0.4681,
+            0.2748, 0.3405, 0.3255, 0.2926, 0.4282, 0.4681, 0.3879, 0.3916,
+            0.3683, 0.5790, 0.5976, 0.6569, 0.5790, 0.6798, 0.6569, 0.7254,
+            0.4808, 0.5511, 0.6558, 0.6395, 0.6569, 0.7254, 0.6666, 0.6848,
+            0.2748, 0.4282, 0.3255, 0.3879, 0.3405, 0.4681, 0.2926, 0.3916,
+            0.2814, 0.4047, 0.2622, 0.2615, 0.4047, 0.4740, 0.2615, 0.2651,
+            0.4808, 0.6569, 0.6558, 0.6666, 0.5511, 0.7254, 0.6395, 0.6848,
+            0.6353, 0.6990, 0.7153, 0.7215, 0.6990, 0.7697, 0.7215, 0.7249,
+            0.1611, 0.3204, 0.2548, 0.3333, 0.2748, 0.4282, 0.2814, 0.4047,
+            0.2580, 0.3315, 0.2866, 0.2154, 0.3255, 0.3879, 0.2622, 0.2615,
+            0.3140, 0.5403, 0.5241, 0.5706, 0.4808, 0.6569, 0.6353, 0.6990,
+            0.3923, 0.4346, 0.6036, 0.5548, 0.6558, 0.6666, 0.7153, 0.7215,
+            0.1551, 0.2843, 0.1734, 0.2154, 0.2072, 0.2926, 0.1189, 0.2136,
+            0.1734, 0.2154, 0.1095, 0.0730, 0.2604, 0.2615, 0.0974, 0.0932,
+            0.2894, 0.6111, 0.4416, 0.5548, 0.3643, 0.6395, 0.4367, 0.5659,
+            0.4416, 0.5548, 0.5954, 0.6225, 0.5870, 0.7215, 0.6085, 0.6305,
+            0.2058, 0.3405, 0.3662, 0.4047, 0.3405, 0.4681, 0.4047, 0.4740,
+            0.2072, 0.3006, 0.2604, 0.2136, 0.2926, 0.3916, 0.2615, 0.2651,
+            0.3374, 0.5511, 0.6517, 0.6990, 0.5511, 0.7254, 0.6990, 0.7697,
+            0.3643, 0.4525, 0.5870, 0.5659, 0.6395, 0.6848, 0.7215, 0.7249,
+            0.2072, 0.2926, 0.2604, 0.2615, 0.3006, 0.3916, 0.2136, 0.2651,
+            0.1189, 0.2136, 0.0974, 0.0932, 0.2136, 0.2651, 0.0932, 0.0855,
+            0.3643, 0.6395, 0.5870, 0.7215, 0.4525, 0.6848, 0.5659, 0.7249,
+            0.4367, 0.5659, 0.6085, 0.6305, 0.5659, 0.7249, 0.6305, 0.6294
+        };
+
+        /*
+         *  window()
+         *
+         *  @t1: The board to read.
+         *  @i: The row index of the window center.
+         *  @j: The column index of the window center.
+         *
+         *  return:
+         *    - The index of the 3x3 window centered at (i, j) into
+         *    `window_stats`.
+         */
+        static std::size_t window(const Matrix<int>& t1, std::size_t i, std::size_t j) {
+
+            int x;
+            int y;
+            int n;
+            int m;
+            std::size_t k;
+            std::size_t idx;
+
+            n = (int)t1.n();
+            m = (int)t1.m();
+
+            idx = 0;
+            for(k = 0; k < 9; k++) {
+                x = (int)(i + k / 3) - 1;
+                y = (int)(j + k % 3) - 1;
+                if((x >= 0 && x < n) && (y >= 0 && y < m) && t1(x, y)) {
+                    idx |= std::size_t(1) << k;
+                }
+            }
+
+            return idx;
+        }
+    }
+
+    /*
+     *  alive_prob()
+     *
+     *  Estimates, from precomputed window statistics, the probability
+     *  that each t0 cell is alive given the 3x3 neighbourhood of the
+     *  same cell at t1. Cells outside of the board are read as dead.
+     *
+     *  @t1: The known state of the board at time t1. Each cell is
+     *  either `1` (alive) or `0` (dead).
+     *
+     *  @prob: Receives the estimated probabilities. Must have the same
+     *  dimensions as `t1`.
+     */
+    void alive_prob(const Matrix<int>& t1, Matrix<double>& prob) {
+
+        std::size_t i;
+        std::size_t j;
+        std::size_t n;
+        std::size_t m;
+
+        n = t1.n();
+        m = t1.m();
+        for(i = 0; i < n; i++) {
+            for(j = 0; j < m; j++) {
+                prob(i, j) = window_stats[window(t1, i, j)];
+            }
+        }
+    }
+}
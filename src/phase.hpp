@@ -0,0 +1,33 @@
+#ifndef PHASE_HPP
+#define PHASE_HPP
+
+#include "matrix.hpp"
+
+namespace phase {
+
+    /*
+     *  Confidence thresholds on the probability of a t0 cell being
+     *  alive. Cells at or below `dead` are hinted dead, cells at or
+     *  above `alive` are hinted alive and everything in between is
+     *  left to the solver.
+     */
+    constexpr double dead  = 0.10;
+    constexpr double alive = 0.70;
+
+    /*
+     *  alive_prob()
+     *
+     *  Estimates, from precomputed window statistics, the probability
+     *  that each t0 cell is alive given the 3x3 neighbourhood of the
+     *  same cell at t1. Cells outside of the board are read as dead.
+     *
+     *  @t1: The known state of the board at time t1. Each cell is
+     *  either `1` (alive) or `0` (dead).
+     *
+     *  @prob: Receives the estimated probabilities. Must have the same
+     *  dimensions as `t1`.
+     */
+    extern void alive_prob(const Matrix<int>& t1, Matrix<double>& prob);
+};
+
+#endif  /* PHASE_HPP */
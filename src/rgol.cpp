@@ -3,6 +3,7 @@
 #include <z3++.h>
 
 #include "matrix.hpp"
+#include "phase.hpp"
 
 /*
  *  time_it()
@@ -128,6 +129,9 @@ namespace rgol {
          *  @ct0: A symbolic matrix of Z3 expressions representing the
          *  state of the Game of Life board at time t0.
          *
+         *  @support: The t0 support mask. Neighbors outside of it are
+         *  fixed dead and are left out of the sum.
+         *
          *  @i: The row index of the cell for which the neighbor sum is
          *  being computed.
          *
@@ -140,7 +144,7 @@ namespace rgol {
          *    matrix.
          */
         template <class T>
-        static z3::expr neigh_sum(State<T>& st, const Matrix<z3::expr>& ct0, std::size_t i, std::size_t j) {
+        static z3::expr neigh_sum(State<T>& st, const Matrix<z3::expr>& ct0, const Matrix<int>& support, std::size_t i, std::size_t j) {
 
             int x;
             int y;
@@ -161,7 +165,7 @@ namespace rgol {
             for(k = 0; k < max_neigh; k++) {
                 x = (int)(off[k][0] + i);
                 y = (int)(off[k][1] + j);
-                if((x >= 0 && x < n) && (y >= 0 && y < m)) {
+                if((x >= 0 && x < n) && (y >= 0 && y < m) && support(x, y)) {
                     sum = sum + z3::ite(ct0(x, y), st.env.one, st.env.zero);
                 }
             }
@@ -169,6 +173,77 @@ namespace rgol {
             return sum;
         }
 
+        /*
+         *  in_reach()
+         *
+         *  Checks whether the cell at position (i, j) can be alive at
+         *  time t1 given the support mask, i.e. whether any cell of its
+         *  3x3 neighbourhood (the cell itself included) lies inside the
+         *  support at time t0.
+         *
+         *  @support: The t0 support mask. Cells set to `0` are fixed
+         *  dead.
+         *
+         *  @i: The row index of the cell.
+         *  @j: The column index of the cell.
+         *
+         *  return:
+         *    - `true` if at least one cell of the neighbourhood is inside
+         *    the support, `false` otherwise.
+         */
+        static bool in_reach(const Matrix<int>& support, std::size_t i, std::size_t j) {
+
+            std::size_t x;
+            std::size_t y;
+            std::size_t n;
+            std::size_t m;
+
+            n = support.n();
+            m = support.m();
+            for(x = (i ? i - 1 : 0); x <= i + 1 && x < n; x++) {
+                for(y = (j ? j - 1 : 0); y <= j + 1 && y < m; y++) {
+                    if(support(x, y)) {
+                        return true;
+                    }
+                }
+            }
+
+            return false;
+        }
+
+        /*
+         *  count_support()
+         *
+         *  Counts the cells of the support mask that may be alive at
+         *  time t0. This is the largest alive-cell count any solution
+         *  can have.
+         *
+         *  @support: The t0 support mask.
+         *
+         *  return:
+         *    - The number of non-zero cells in `support`.
+         */
+        static std::size_t count_support(const Matrix<int>& support) {
+
+            std::size_t i;
+            std::size_t j;
+            std::size_t n;
+            std::size_t m;
+            std::size_t sum;
+
+            n = support.n();
+            m = support.m();
+
+            sum = 0;
+            for(i = 0; i < n; i++) {
+                for(j = 0; j < m; j++) {
+                    sum += support(i, j) ? 1 : 0;
+                }
+            }
+
+            return sum;
+        }
+
         /*
          *  add_clauses()
          *
@@ -190,13 +265,18 @@ namespace rgol {
          *  @ct0: A symbolic matrix of Z3 expressions representing the
          *  state of the board at t0.
          *
+         *  @support: The t0 support mask. Cells whose neighbourhood lies
+         *  entirely outside of it can only be dead at t1, so no rule is
+         *  encoded for them; if such a cell is alive in `t1` the
+         *  problem is made unsatisfiable right away.
+         *
          *  return:
          *    - A Z3 symbolic expression representing the total number
          *    of alive cells in `ct0`.  This expression can be used
          *    for optimization to minimize the alive cell count in t0.
          */
         template <class T>
-        static z3::expr add_clauses(State<T>& st, const Matrix<int>& t1, const Matrix<z3::expr>& ct1, Matrix<z3::expr>& ct0) {
+        static z3::expr add_clauses(State<T>& st, const Matrix<int>& t1, const Matrix<z3::expr>& ct1, Matrix<z3::expr>& ct0, const Matrix<int>& support) {
 
             std::size_t i;
             std::size_t j;
@@ -211,8 +291,17 @@ namespace rgol {
 
             for(i = 0; i < n; i++) {
                 for(j = 0; j < m; j++) {
-                    neigh = neigh_sum(st, ct0, i, j);
-                    total = total + z3::ite(ct0(i, j), st.env.one, st.env.zero);
+                    if(!in_reach(support, i, j)) {
+                        if(t1(i, j)) {
+                            st.solver.add(st.env.expr_false);
+                        }
+                        continue;
+                    }
+
+                    neigh = neigh_sum(st, ct0, support, i, j);
+                    if(support(i, j)) {
+                        total = total + z3::ite(ct0(i, j), st.env.one, st.env.zero);
+                    }
 
                     /* Game of Life rules */
                     st.solver.add(
@@ -250,9 +339,12 @@ namespace rgol {
          *
          *  @ct0: A symbolic matrix of Z3 expressions representing the
          *  state of t0 in the solver.
+         *
+         *  @support: The t0 support mask. Cells outside of it are bound
+         *  to the constant `false` instead of a fresh variable.
          */
         template <class T>
-        static void init_repr(State<T>& st, const Matrix<int>& t1, Matrix<z3::expr>& ct1, Matrix<z3::expr>& ct0) {
+        static void init_repr(State<T>& st, const Matrix<int>& t1, Matrix<z3::expr>& ct1, Matrix<z3::expr>& ct0, const Matrix<int>& support) {
             
             std::size_t i;
             std::size_t j;
@@ -271,7 +363,7 @@ namespace rgol {
                     n0 = "t0_" + k;
                     n1 = "t1_" + k;
 
-                    ct0(i, j) = st.ctx.bool_const(n0.c_str());
+                    ct0(i, j) = support(i, j) ? st.ctx.bool_const(n0.c_str()) : st.env.expr_false;
                     ct1(i, j) = st.ctx.bool_const(n1.c_str());
                     st.solver.add(
                         ct1(i, j) == (
@@ -285,6 +377,154 @@ namespace rgol {
             }
         }
 
+        /*
+         *  phase_hints()
+         *
+         *  Builds the list of phase hints for the t0 variables from the
+         *  local t1 window statistics (see `phase::alive_prob`). Only
+         *  confident cells inside the support are hinted. The hints are
+         *  meant to be passed as assumptions, which Z3 treats as hard
+         *  literals rather than branching priorities: either the model
+         *  honours all of them or the check fails with an unsat core.
+         *
+         *  @st: The state object containing the Z3 context.
+         *
+         *  @t1: The matrix representing the known state of the Game of
+         *  Life board at time t1.
+         *
+         *  @ct0: A symbolic matrix of Z3 expressions representing the
+         *  state of the board at t0.
+         *
+         *  @support: The t0 support mask. Cells outside of it are
+         *  constants and are never hinted.
+         *
+         *  return:
+         *    - A vector of literals, `ct0(i, j)` for cells hinted alive
+         *    and `!ct0(i, j)` for cells hinted dead.
+         */
+        template <class T>
+        static z3::expr_vector phase_hints(State<T>& st, const Matrix<int>& t1, const Matrix<z3::expr>& ct0, const Matrix<int>& support) {
+
+            std::size_t i;
+            std::size_t j;
+            std::size_t n;
+            std::size_t m;
+
+            n = t1.n();
+            m = t1.m();
+
+            Matrix<double> prob(n, m);
+            z3::expr_vector hints(st.ctx);
+
+            phase::alive_prob(t1, prob);
+            for(i = 0; i < n; i++) {
+                for(j = 0; j < m; j++) {
+                    if(!support(i, j)) {
+                        continue;
+                    }
+
+                    if(prob(i, j) <= phase::dead) {
+                        hints.push_back(!ct0(i, j));
+                    } else if(prob(i, j) >= phase::alive) {
+                        hints.push_back(ct0(i, j));
+                    }
+                }
+            }
+
+            return hints;
+        }
+
+        /*
+         *  check_hinted()
+         *
+         *  Checks the solver under the phase hints, passed as
+         *  assumptions, and falls back to a single unhinted check if
+         *  they conflict or do not pay off within `1 / hint_share` of
+         *  the budget. Both checks share one deadline, so the call
+         *  never runs longer than `timeout`. With less than
+         *  `hint_share` milliseconds left, the hints are skipped.
+         *
+         *  Hints in the unsat core are dropped for good only when the
+         *  unhinted check proves the same constraints satisfiable. An
+         *  infeasible bound says nothing about the hints, and Z3 cores
+         *  are not minimal, so in that case the hints are kept. If the
+         *  hinted check ran out of its share while the unhinted one
+         *  succeeds, the hints are not helping and are all dropped.
+         *
+         *  @st: The state object containing the Z3 solver.
+         *
+         *  @p: The solver parameters; their timeout is updated before
+         *  every check.
+         *
+         *  @hints: The phase hints. Hints shown to be wrong are removed
+         *  so later checks do not pay for them again.
+         *
+         *  @timeout: The time limit (in milliseconds) for the call.
+         *
+         *  return:
+         *    - The result of the last check.
+         */
+        template <class T>
+        static z3::check_result check_hinted(State<T>& st, z3::params& p, z3::expr_vector& hints, unsigned timeout) {
+
+            unsigned c;
+            bool wrong;
+            bool stale;
+
+            constexpr unsigned hint_share = 4;
+
+            z3::check_result res;
+            z3::expr_vector core(st.ctx);
+
+            /* A zero timeout means no limit to Z3, so skip the hints */
+            stale = false;
+            if(!hints.empty() && timeout >= hint_share) {
+                p.set("timeout", timeout / hint_share);
+                st.solver.set(p);
+                time_it(timeout,
+                    res = st.solver.check(hints);
+                );
+                if(res == z3::sat) {
+                    return res;
+                }
+
+                /* The core is only valid until the next check */
+                if(res == z3::unsat) {
+                    core = st.solver.unsat_core();
+                    if(core.empty()) {
+                        return res;
+                    }
+                } else {
+                    stale = true;
+                }
+
+                if(!timeout) {
+                    return z3::unknown;
+                }
+            }
+
+            p.set("timeout", timeout);
+            st.solver.set(p);
+            res = st.solver.check();
+            if(res == z3::sat && stale) {
+                hints = z3::expr_vector(st.ctx);
+            } else if(res == z3::sat && !core.empty()) {
+                z3::expr_vector kept(st.ctx);
+                for(const auto& h : hints) {
+                    wrong = false;
+                    for(c = 0; c < core.size() && !wrong; c++) {
+                        wrong = z3::eq(h, core[c]);
+                    }
+                    if(!wrong) {
+                        kept.push_back(h);
+                    }
+                }
+                hints = kept;
+            }
+
+            return res;
+        }
+
         /*
          *  fill_t0()
          *
@@ -395,6 +635,11 @@ namespace rgol {
      *  pre-initialized with the appropriate dimensions corresponding
      *  to `t1`.
      *
+     *  @support: A constant reference to a `Matrix<int>` of the same
+     *  dimensions as `t1` restricting where t0 activity may lie.
+     *  Cells set to `0` are fixed dead and never become solver
+     *  variables.
+     *
      *  @timeout: The time limit (in milliseconds) for the solver. If
      *  the solver exceeds this limit, it terminates and returns no
      *  solution.
@@ -402,6 +647,10 @@ namespace rgol {
      *  @threads: An integer specifying the number of threads to
      *  enable for the Z3 solver.
      *
+     *  @hinted: If `true`, every check is first tried under phase hints
+     *  derived from local t1 window statistics (see `phase.hpp`). Off
+     *  by default in `Board`, as it only pays off on some boards.
+     *
      *  return:
      *    - `true`: Indicates that a valid previous state (`t0`) was
      *    found that evolves into the given state (`t1`) under the
@@ -410,7 +659,7 @@ namespace rgol {
      *    - `false`: Indicates that no such previous state exists for
      *    the provided `t1` state.
      */
-    bool solve_iter(const Matrix<int>& t1, Matrix<int>& t0, unsigned timeout, unsigned threads, bool& sat) {
+    bool solve_iter(const Matrix<int>& t1, Matrix<int>& t0, const Matrix<int>& support, unsigned timeout, unsigned threads, bool hinted, bool& sat) {
 
         std::size_t cur;
         std::size_t max;
@@ -432,18 +681,17 @@ namespace rgol {
             sol
         };
 
-        init_repr(st, t1, ct1, ct0);
-        z3::expr total = add_clauses(st, t1, ct1, ct0);
+        init_repr(st, t1, ct1, ct0, support);
+        z3::expr total = add_clauses(st, t1, ct1, ct0, support);
+        z3::expr_vector hints = hinted ? phase_hints(st, t1, ct0, support) : z3::expr_vector(ctx);
 
         sat = false;
-        max = t0.n() * t0.m();
+        max = count_support(support);
         for(int i = max; i >= 0 && timeout; i--) {
             time_it(timeout, 
-                p.set("timeout", timeout);
-                sol.set(p);
                 sol.push(); 
                 sol.add(total <= ctx.int_val(max));
-                if(sol.check() == z3::sat) {
+                if(check_hinted(st, p, hints, timeout) == z3::sat) {
                     cur = count_ones(st, ct0);
                     if(cur <= max) {
                         fill_t0(st, ct0, t0);
@@ -478,6 +726,11 @@ namespace rgol {
      *  pre-initialized with the appropriate dimensions corresponding
      *  to `t1`.
      *
+     *  @support: A constant reference to a `Matrix<int>` of the same
+     *  dimensions as `t1` restricting where t0 activity may lie.
+     *  Cells set to `0` are fixed dead and never become solver
+     *  variables.
+     *
      *  @timeout: The time limit (in milliseconds) for the solver. If
      *  the solver exceeds this limit, it terminates and returns no
      *  solution.
@@ -490,7 +743,7 @@ namespace rgol {
      *    - `false`: Indicates that no such previous state exists for
      *    the provided `t1` state.
      */
-    bool solve(const Matrix<int>& t1, Matrix<int>& t0, unsigned timeout) {
+    bool solve(const Matrix<int>& t1, Matrix<int>& t0, const Matrix<int>& support, unsigned timeout) {
 
         bool sat;
 
@@ -513,8 +766,8 @@ namespace rgol {
         };
 
         sat = false;
-        init_repr(st, t1, ct1, ct0);
-        opt.minimize(add_clauses(st, t1, ct1, ct0));
+        init_repr(st, t1, ct1, ct0, support);
+        opt.minimize(add_clauses(st, t1, ct1, ct0, support));
         if(opt.check() == z3::sat) {
             fill_t0(st, ct0, t0);
             sat = true;
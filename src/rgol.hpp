@@ -27,6 +27,11 @@ namespace rgol {
      *  pre-initialized with the appropriate dimensions corresponding
      *  to `t1`.
      *
+     *  @support: A constant reference to a `Matrix<int>` of the same
+     *  dimensions as `t1` restricting where t0 activity may lie.
+     *  Cells set to `0` are fixed dead and never become solver
+     *  variables.
+     *
      *  @timeout: The time limit (in milliseconds) for the solver. If
      *  the solver exceeds this limit, it terminates and returns no
      *  solution.
@@ -34,6 +39,10 @@ namespace rgol {
      *  @threads: An integer specifying the number of threads to
      *  enable for the Z3 solver.
      *
+     *  @hinted: If `true`, every check is first tried under phase hints
+     *  derived from local t1 window statistics (see `phase.hpp`). Off
+     *  by default in `Board`, as it only pays off on some boards.
+     *
      *  return:
      *    - `true`: Indicates that a valid previous state (`t0`) was
      *    found that evolves into the given state (`t1`) under the
@@ -42,7 +51,7 @@ namespace rgol {
      *    - `false`: Indicates that no such previous state exists for
      *    the provided `t1` state.
      */
-    extern bool solve_iter(const Matrix<int>& t1, Matrix<int>& t0, unsigned timeout, unsigned threads, bool& sat);
+    extern bool solve_iter(const Matrix<int>& t1, Matrix<int>& t0, const Matrix<int>& support, unsigned timeout, unsigned threads, bool hinted, bool& sat);
 
     /*
      *  solve_min_alive()
@@ -62,6 +71,11 @@ namespace rgol {
      *  pre-initialized with the appropriate dimensions corresponding
      *  to `t1`.
      *
+     *  @support: A constant reference to a `Matrix<int>` of the same
+     *  dimensions as `t1` restricting where t0 activity may lie.
+     *  Cells set to `0` are fixed dead and never become solver
+     *  variables.
+     *
      *  @timeout: The time limit (in milliseconds) for the solver. If
      *  the solver exceeds this limit, it terminates and returns no
      *  solution.
@@ -74,7 +88,7 @@ namespace rgol {
      *    - `false`: Indicates that no such previous state exists for
      *    the provided `t1` state.
      */
-    extern bool solve(const Matrix<int>& t1, Matrix<int>& t0, unsigned timeout);
+    extern bool solve(const Matrix<int>& t1, Matrix<int>& t0, const Matrix<int>& support, unsigned timeout);
 };
 
 #endif  /* RGOL_HPP */
@@ -0,0 +1,642 @@
+
+#include <iostream>
+#include <fstream>
+#include <iomanip>
+#include <string>
+#include <vector>
+#include <memory>
+#include <thread>
+#include <atomic>
+#include <mutex>
+#include <chrono>
+#include <bit>
+#include <cstdint>
+#include <cstdlib>
+#include <cerrno>
+#include <limits>
+#include <unistd.h>
+#include <sys/resource.h>
+
+#include "../src/board.hpp"
+#include "../src/utils.hpp"
+
+namespace {
+
+    using clock_type = std::chrono::steady_clock;
+
+    /*
+     *  Upper bound on the open-loop arrival rate, keeping the interval
+     *  between two arrivals well above the clock resolution.
+     */
+    constexpr double max_rate = 1e6;
+
+    /*
+     *  Histogram
+     *
+     *  Log-linear latency histogram in the spirit of HdrHistogram.
+     *  Values below 2^precision are recorded exactly; above that each
+     *  power-of-two range is split into 2^(precision - 1) linear
+     *  sub-buckets, which keeps the relative error at or below
+     *  2^-(precision - 1) (under 0.8% for the default precision) while
+     *  using a fixed amount of memory.
+     */
+    class Histogram {
+
+        public:
+
+        static constexpr unsigned precision = 8;
+        static constexpr std::uint64_t sub = std::uint64_t(1) << precision;
+
+        /*
+         *  Histogram()
+         *
+         *  Constructs an empty histogram able to record any 64-bit
+         *  value.
+         */
+        Histogram() : counts((64 - precision + 1) * (sub / 2) + sub / 2, 0), total(0), max(0) {}
+
+        /*
+         *  record()
+         *
+         *  @v: The value (in microseconds) to record.
+         */
+        void record(std::uint64_t v) {
+            counts[index(v)]++;
+            total++;
+            if(v > max) {
+                max = v;
+            }
+        }
+
+        /*
+         *  percentile()
+         *
+         *  @p: The percentile to query, in the range [0, 100].
+         *
+         *  return:
+         *    - The highest value equivalent to the bucket holding the
+         *    requested percentile, or `0` if the histogram is empty.
+         */
+        std::uint64_t percentile(double p) const {
+
+            std::size_t i;
+            std::uint64_t seen;
+            std::uint64_t rank;
+
+            if(!total) {
+                return 0;
+            }
+
+            rank = (std::uint64_t)((p / 100.0) * total + 0.5);
+            if(rank < 1) {
+                rank = 1;
+            }
+
+            seen = 0;
+            for(i = 0; i < counts.size(); i++) {
+                seen += counts[i];
+                if(seen >= rank) {
+                    return std::min(highest(i), max);
+                }
+            }
+
+            return max;
+        }
+
+        /*
+         *  print()
+         *
+         *  Writes an HdrHistogram-style percentile distribution to the
+         *  given stream, halving the distance to 100% at every step
+         *  until every recorded value has been covered.
+         *
+         *  @os: The output stream to write the distribution to.
+         *  @scale: Divisor applied to every value (e.g. 1000 for ms).
+         */
+        void print(std::ostream& os, double scale) const {
+
+            double p;
+            double step;
+
+            os << std::setw(12) << "Value" << " "
+               << std::setw(14) << "Percentile" << " "
+               << std::setw(10) << "TotalCount" << "\n";
+
+            if(!total) {
+                return;
+            }
+
+            p = 0.0;
+            step = 25.0;
+            while(p < 100.0 && step >= 1e-4) {
+                if(line(os, p, scale) == total) {
+                    return;
+                }
+                if(p + step >= 100.0 - 1e-9) {
+                    step /= 2.0;
+                }
+                p += step;
+            }
+            line(os, 100.0, scale);
+        }
+
+        private:
+
+        /*
+         *  index()
+         *
+         *  @v: The value to map.
+         *
+         *  return:
+         *    - The bucket index holding `v`.
+         */
+        static std::size_t index(std::uint64_t v) {
+
+            unsigned e;
+
+            e = std::bit_width(v | (sub - 1)) - precision;
+            return e * (sub / 2) + (v >> e);
+        }
+
+        /*
+         *  highest()
+         *
+         *  @i: A bucket index.
+         *
+         *  return:
+         *    - The largest value that maps to bucket `i`.
+         */
+        static std::uint64_t highest(std::size_t i) {
+
+            std::uint64_t e;
+            std::uint64_t s;
+
+            if(i < sub) {
+                return i;
+            }
+
+            e = i / (sub / 2) - 1;
+            s = i - e * (sub / 2);
+            return ((s + 1) << e) - 1;
+        }
+
+        /*
+         *  line()
+         *
+         *  Writes a single row of the percentile distribution.
+         *
+         *  return:
+         *    - The number of recorded values at or below the row value.
+         */
+        std::uint64_t line(std::ostream& os, double p, double scale) const {
+
+            std::uint64_t v;
+            std::uint64_t below;
+            std::size_t i;
+
+            v = percentile(p);
+
+            below = 0;
+            for(i = 0; i <= index(v); i++) {
+                below += counts[i];
+            }
+
+            os << std::fixed
+               << std::setw(12) << std::setprecision(3) << v / scale << " "
+               << std::setw(14) << std::setprecision(10) << p / 100.0 << " "
+               << std::setw(10) << below << "\n";
+
+            return below;
+        }
+
+        private:
+
+        std::vector<std::uint64_t> counts;
+        std::uint64_t total;
+        std::uint64_t max;
+    };
+
+    struct Options {
+
+        /* Open loop: requests per second (0 selects closed loop) */
+        double rate = 0.0;
+
+        /* Closed loop: number of outstanding requests */
+        unsigned concurrency = 1;
+
+        /* Open loop: arrivals beyond this many in flight are dropped */
+        unsigned max_inflight = 16;
+
+        /* Length of the measured run in seconds */
+        unsigned duration = 60;
+
+        /* Per-request solver budget in seconds */
+        unsigned timeout = 290;
+
+        /* Seed the solver with phase hints */
+        bool hinted = false;
+
+        std::vector<std::string> corpus;
+    };
+
+    /*
+     *  Entry
+     *
+     *  A corpus board together with its optional t0 support mask.
+     */
+    struct Entry {
+        std::unique_ptr<Board> board;
+        std::unique_ptr<Board> support;
+    };
+
+    struct Stats {
+
+        std::mutex lock;
+
+        /* Latency from the scheduled start, queueing included */
+        Histogram latency;
+
+        /* Time spent inside previous_state() */
+        Histogram service;
+
+        std::atomic<std::uint64_t> done{0};
+        std::atomic<std::uint64_t> overruns{0};
+        std::atomic<std::uint64_t> unsolved{0};
+        std::atomic<std::uint64_t> suboptimal{0};
+        std::atomic<std::uint64_t> dropped{0};
+        std::atomic<std::uint64_t> errors{0};
+        std::atomic<unsigned> inflight{0};
+    };
+
+    /*
+     *  parse_uint()
+     *
+     *  @arg: The option argument.
+     *  @out: Receives the parsed value.
+     *
+     *  return:
+     *    - `true` if `arg` is a whole positive decimal number that fits
+     *    in an `unsigned`, `false` otherwise.
+     */
+    bool parse_uint(const char* arg, unsigned& out) {
+
+        char* end;
+        unsigned long v;
+
+        if(*arg < '0' || *arg > '9') {
+            return false;
+        }
+
+        errno = 0;
+        v = std::strtoul(arg, &end, 10);
+        if(errno || *end || !v || v > std::numeric_limits<unsigned>::max()) {
+            return false;
+        }
+
+        out = (unsigned)v;
+        return true;
+    }
+
+    /*
+     *  parse_rate()
+     *
+     *  @arg: The option argument.
+     *  @out: Receives the parsed value.
+     *
+     *  return:
+     *    - `true` if `arg` is a number in (0, max_rate], `false`
+     *    otherwise.
+     */
+    bool parse_rate(const char* arg, double& out) {
+
+        char* end;
+        double v;
+
+        errno = 0;
+        v = std::strtod(arg, &end);
+        if(errno || end == arg || *end || !(v > 0.0 && v <= max_rate)) {
+            return false;
+        }
+
+        out = v;
+        return true;
+    }
+
+    /*
+     *  usage()
+     *
+     *  @prog: The program name as found in argv[0].
+     */
+    void usage(const char* prog) {
+        std::cerr
+            << "usage: " << prog << " [-r rate [-m max] | -c concurrency] [-d seconds] [-t timeout] [-p] board...\n"
+            << "\n"
+            << "  -r rate         open loop: issue `rate` requests per second (at most 1e6)\n"
+            << "  -m max          open loop: drop arrivals while `max` requests are in flight (default 16)\n"
+            << "  -c concurrency  closed loop: keep `concurrency` requests in flight (default 1)\n"
+            << "  -d seconds      length of the run (default 60)\n"
+            << "  -t timeout      per-request solver budget in seconds (default 290)\n"
+            << "  -p              seed the solver with phase hints\n";
+    }
+
+    /*
+     *  load_corpus()
+     *
+     *  Reads every board file (same format as the `t1` binary expects
+     *  on stdin, including the optional support mask block) into
+     *  memory.
+     *
+     *  @paths: The files to read.
+     *  @boards: Receives the parsed boards and masks.
+     *
+     *  return:
+     *    - `true` if every file was read successfully, `false`
+     *    otherwise.
+     */
+    bool load_corpus(const std::vector<std::string>& paths, std::vector<Entry>& boards) {
+
+        std::size_t n;
+        std::size_t m;
+
+        for(const auto& path : paths) {
+            std::ifstream in(path);
+            if(!(in >> n >> m)) {
+                std::cerr << path << ": cannot read board dimensions\n";
+                return false;
+            }
+
+            auto board = std::make_unique<Board>(n, m);
+            if(!(in >> *board)) {
+                std::cerr << path << ": cannot read board\n";
+                return false;
+            }
+
+            std::unique_ptr<Board> support;
+            if(!(in >> std::ws).eof()) {
+                support = std::make_unique<Board>(n, m);
+                if(!(in >> *support)) {
+                    std::cerr << path << ": cannot read support mask\n";
+                    return false;
+                }
+            }
+
+            boards.push_back(Entry{std::move(board), std::move(support)});
+        }
+
+        return true;
+    }
+
+    /*
+     *  issue()
+     *
+     *  Runs a single request and records two timings: the latency
+     *  measured from `intended`, the time the request was scheduled to
+     *  start, and the service time spent inside `previous_state()`. For
+     *  the open loop the former charges queueing delay to the request
+     *  and avoids coordinated omission.
+     *
+     *  A request whose latency reaches the solver budget counts as a
+     *  deadline overrun. The solve status reported by
+     *  `previous_state()` is tallied separately: requests for which no
+     *  predecessor was found (unsatisfiable or out of time), and
+     *  requests answered with a predecessor whose minimality search did
+     *  not finish in time.
+     *
+     *  @entry: The board (and optional mask) whose previous state is
+     *  requested.
+     *
+     *  @opts: The run options.
+     *  @stats: The shared statistics.
+     *  @intended: The scheduled start time of the request.
+     */
+    void issue(const Entry& entry, const Options& opts, Stats& stats, clock_type::time_point intended) {
+
+        std::uint64_t lat;
+        std::uint64_t svc;
+        std::uint64_t budget;
+
+        std::pair<bool, bool> status;
+
+        auto start = clock_type::now();
+        try {
+            if(entry.support) {
+                entry.board->previous_state(*entry.support, opts.timeout, status);
+            } else {
+                entry.board->previous_state(opts.timeout, status);
+            }
+        } catch(std::exception&) {
+            stats.errors++;
+            return;
+        }
+        auto end = clock_type::now();
+
+        lat = std::chrono::duration_cast<std::chrono::microseconds>(end - intended).count();
+        svc = std::chrono::duration_cast<std::chrono::microseconds>(end - start).count();
+
+        budget = (std::uint64_t)opts.timeout * 1000000;
+        if(lat >= budget) {
+            stats.overruns++;
+        }
+        if(!status.first) {
+            stats.unsolved++;
+        } else if(!status.second) {
+            stats.suboptimal++;
+        }
+
+        std::lock_guard<std::mutex> guard(stats.lock);
+        stats.latency.record(lat);
+        stats.service.record(svc);
+        stats.done++;
+    }
+
+    /*
+     *  open_loop()
+     *
+     *  Issues requests at a constant arrival rate, cycling through the
+     *  corpus. Arrivals that find `max_inflight` requests still running
+     *  are counted as dropped instead of being started, which keeps
+     *  threads and memory bounded when the rate exceeds the service
+     *  rate. Finished requests are reaped as the run goes.
+     */
+    void open_loop(const std::vector<Entry>& boards, const Options& opts, Stats& stats) {
+
+        std::size_t k;
+
+        std::vector<std::future<void>> inflight;
+
+        auto start    = clock_type::now();
+        auto end      = start + std::chrono::seconds(opts.duration);
+        auto interval = std::chrono::duration_cast<clock_type::duration>(
+            std::chrono::duration<double>(1.0 / opts.rate)
+        );
+
+        auto next = start;
+        for(k = 0; next < end; k++, next += interval) {
+            std::this_thread::sleep_until(next);
+
+            std::erase_if(inflight,
+                [](std::future<void>& fut) {
+                    return fut.wait_for(std::chrono::seconds(0)) == std::future_status::ready;
+                }
+            );
+
+            if(stats.inflight >= opts.max_inflight) {
+                stats.dropped++;
+                continue;
+            }
+
+            const Entry& entry = boards[k % boards.size()];
+            stats.inflight++;
+            auto fut = utils::launch_future(
+                [&entry, &opts, &stats, next]() {
+                    issue(entry, opts, stats, next);
+                    stats.inflight--;
+                }
+            );
+
+            if(fut.has_value()) {
+                inflight.push_back(std::move(fut.value()));
+            } else {
+                stats.inflight--;
+                stats.errors++;
+            }
+        }
+
+        for(auto& fut : inflight) {
+            fut.wait();
+        }
+    }
+
+    /*
+     *  closed_loop()
+     *
+     *  Keeps `concurrency` workers busy, each issuing its next request
+     *  as soon as the previous one completes.
+     */
+    void closed_loop(const std::vector<Entry>& boards, const Options& opts, Stats& stats) {
+
+        unsigned i;
+
+        std::atomic<std::size_t> next{0};
+        std::vector<std::thread> workers;
+
+        auto end = clock_type::now() + std::chrono::seconds(opts.duration);
+
+        for(i = 0; i < opts.concurrency; i++) {
+            workers.emplace_back(
+                [&]() {
+                    while(clock_type::now() < end) {
+                        const Entry& entry = boards[next++ % boards.size()];
+                        issue(entry, opts, stats, clock_type::now());
+                    }
+                }
+            );
+        }
+
+        for(auto& worker : workers) {
+            worker.join();
+        }
+    }
+
+    /*
+     *  report()
+     *
+     *  Prints the summary and the latency distribution.
+     */
+    void report(const Options& opts, Stats& stats, double elapsed) {
+
+        struct rusage usage;
+
+        getrusage(RUSAGE_SELF, &usage);
+
+        std::cout << std::fixed << std::setprecision(3)
+            << "mode:        " << (opts.rate > 0.0 ? "open" : "closed") << " loop";
+        if(opts.rate > 0.0) {
+            std::cout << " (" << opts.rate << " req/s, at most " << opts.max_inflight << " in flight)\n";
+        } else {
+            std::cout << " (" << opts.concurrency << " in flight)\n";
+        }
+
+        std::cout
+            << "elapsed:     " << elapsed << " s\n"
+            << "completed:   " << stats.done << "\n"
+            << "dropped:     " << stats.dropped << " (in-flight cap reached)\n"
+            << "overruns:    " << stats.overruns << " (latency >= budget)\n"
+            << "unsolved:    " << stats.unsolved << " (no predecessor found)\n"
+            << "suboptimal:  " << stats.suboptimal << " (minimum search timed out)\n"
+            << "errors:      " << stats.errors << "\n"
+            << "throughput:  " << (elapsed > 0.0 ? stats.done / elapsed : 0.0) << " req/s\n"
+            << "max rss:     " << usage.ru_maxrss << " KiB\n"
+            << "\n"
+            << "             latency       service\n"
+            << "p50:   " << std::setw(12) << stats.latency.percentile(50.0) / 1000.0
+                         << std::setw(12) << stats.service.percentile(50.0) / 1000.0 << " ms\n"
+            << "p99:   " << std::setw(12) << stats.latency.percentile(99.0) / 1000.0
+                         << std::setw(12) << stats.service.percentile(99.0) / 1000.0 << " ms\n"
+            << "p999:  " << std::setw(12) << stats.latency.percentile(99.9) / 1000.0
+                         << std::setw(12) << stats.service.percentile(99.9) / 1000.0 << " ms\n"
+            << "\n"
+            << "latency distribution (ms):\n";
+
+        stats.latency.print(std::cout, 1000.0);
+
+        std::cout << "\nservice time distribution (ms):\n";
+        stats.service.print(std::cout, 1000.0);
+    }
+}
+
+int main(int argc, char* argv[]) {
+
+    int c;
+    bool ok;
+    bool closed;
+    bool capped;
+
+    Options opts;
+    Stats stats;
+
+    std::vector<Entry> boards;
+
+    ok = true;
+    closed = false;
+    capped = false;
+    while(ok && (c = getopt(argc, argv, "r:m:c:d:t:ph")) != -1) {
+        switch(c) {
+            case 'r': ok = parse_rate(optarg, opts.rate);                          break;
+            case 'm': ok = parse_uint(optarg, opts.max_inflight); capped = true;   break;
+            case 'c': ok = parse_uint(optarg, opts.concurrency); closed = true;    break;
+            case 'd': ok = parse_uint(optarg, opts.duration);                      break;
+            case 't': ok = parse_uint(optarg, opts.timeout);                       break;
+            case 'p': opts.hinted = true;                                          break;
+            default:  ok = false;                                                  break;
+        }
+    }
+
+    for(; optind < argc; optind++) {
+        opts.corpus.emplace_back(argv[optind]);
+    }
+
+    if(!ok || opts.corpus.empty() || (closed && opts.rate > 0.0) || (capped && opts.rate <= 0.0)) {
+        usage(argv[0]);
+        return 1;
+    }
+
+    if(!load_corpus(opts.corpus, boards)) {
+        return 1;
+    }
+
+    for(auto& entry : boards) {
+        entry.board->set_phase_hints(opts.hinted);
+    }
+
+    auto start = clock_type::now();
+    if(opts.rate > 0.0) {
+        open_loop(boards, opts, stats);
+    } else {
+        closed_loop(boards, opts, stats);
+    }
+
+    report(opts, stats, std::chrono::duration<double>(clock_type::now() - start).count());
+
+    return 0;
+}